@@ -22,3 +22,12 @@ function(add_benchmark target)
 #            WORKING_DIRECTORY ${CMAKE_BINARY_DIR}
 #            COMMENT "Running ${target}" VERBATIM)
 endfunction()
+
+# add_optimized_benchmark(<target> <flags> <sources>...)
+#
+# Same as add_benchmark, but <sources> are compiled with the optimization <flags> instead of -O0.
+# Use it for benchmarks whose results depend on the optimizer, such as comparisons of data layouts.
+function(add_optimized_benchmark target flags)
+    add_benchmark(${target} ${ARGN})
+    set_target_properties(${target} PROPERTIES COMPILE_FLAGS " ${flags}")
+endfunction()
@@ -0,0 +1,733 @@
+#include <benchmark/benchmark_api.h>
+#include <math.h>
+#include <stdint.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <EulerAngles.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using namespace flash::math;
+
+using std::vector;
+
+// Runs the core kernels over the same data kept in three layouts, all through the same kernels:
+//   AoS   - std::vector of plain {x, y, z, w} float structs;
+//   SoA   - one contiguous float array per component;
+//   AoSoA - blocks of LANES elements, each block holding one short array per component.
+// Element counts sweep from a working set that fits in L1 to one well past the last level
+// cache; matrix sets stop at MAX_MATRICES, already far past it at 64 bytes per matrix. Every
+// benchmark reports items/s and bytes/s, and its label carries ns/element plus cycles and cache
+// misses per element when perf_event counters can be opened.
+//
+// The slerp and Euler angle kernels call acosf, sinf and cosf, which the compiler does not
+// vectorize, so those rows compare memory access patterns of scalar code, not SIMD layouts.
+
+static const size_t LANES = 8;
+static const int MIN_ELEMENTS = 1 << 8;
+static const int MAX_ELEMENTS = 1 << 22;
+static const int MAX_MATRICES = 1 << 18;
+
+static const float SLERP_FRACTION = 0.3f;
+static const float TO_RADIANS = (float) (M_PI / 180);
+
+class PerfCounter {
+public:
+#ifdef __linux__
+    PerfCounter(uint32_t type, uint64_t config) {
+        perf_event_attr attributes = {};
+        attributes.size = sizeof(attributes);
+        attributes.type = type;
+        attributes.config = config;
+        attributes.disabled = 1;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv = 1;
+        fd = (int) syscall(__NR_perf_event_open, &attributes, 0, -1, -1, 0);
+        if (fd >= 0) {
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+
+    ~PerfCounter() {
+        if (fd >= 0)
+            close(fd);
+    }
+
+    bool available() const {
+        return fd >= 0;
+    }
+
+    uint64_t stop() {
+        uint64_t value = 0;
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(fd, &value, sizeof(value)) != sizeof(value))
+            value = 0;
+        return value;
+    }
+
+private:
+    int fd;
+#else
+    PerfCounter(uint32_t, uint64_t) {}
+
+    bool available() const {
+        return false;
+    }
+
+    uint64_t stop() {
+        return 0;
+    }
+#endif
+
+    PerfCounter(const PerfCounter&) = delete;
+    PerfCounter& operator=(const PerfCounter&) = delete;
+};
+
+#ifndef __linux__
+enum { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_CACHE_MISSES };
+#endif
+
+// Measures one run of a benchmark function; construct it right before the KeepRunning loop.
+class LayoutReport {
+public:
+    LayoutReport()
+            : cycles(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES),
+              cacheMisses(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES),
+              start(std::chrono::steady_clock::now()) {}
+
+    void finish(benchmark::State& state, size_t elements, size_t bytesPerElement) {
+        const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        const double processed = (double) state.iterations() * elements;
+        state.SetItemsProcessed((size_t) processed);
+        state.SetBytesProcessed((size_t) processed * bytesPerElement);
+
+        char label[128];
+        int length = snprintf(label, sizeof(label), "ns/element=%.3f", elapsed.count() / processed);
+        if (cycles.available())
+            length += snprintf(label + length, sizeof(label) - length, " cycles/element=%.2f",
+                    cycles.stop() / processed);
+        if (cacheMisses.available())
+            snprintf(label + length, sizeof(label) - length, " misses/element=%.4f", cacheMisses.stop() / processed);
+        state.SetLabel(label);
+    }
+
+private:
+    PerfCounter cycles;
+    PerfCounter cacheMisses;
+    std::chrono::steady_clock::time_point start;
+};
+
+// No float is reachable through two components of a span, or through two spans passed to the
+// same kernel, which lets the kernels vectorize without run-time alias checks.
+struct Span {
+    float* __restrict__ x;
+    float* __restrict__ y;
+    float* __restrict__ z;
+    float* __restrict__ w;
+
+    float* operator[](int component) const {
+        return component == 0 ? x : component == 1 ? y : component == 2 ? z : w;
+    }
+};
+
+// Every layout is walked as a sequence of spans. Within a span, the components of consecutive
+// elements lie STRIDE floats apart.
+class AoS {
+public:
+    static const size_t STRIDE = 4;
+
+    explicit AoS(size_t size) : elements(size) {}
+
+    size_t spanCount() const {
+        return 1;
+    }
+
+    size_t spanOffset(size_t) const {
+        return 0;
+    }
+
+    size_t spanLength(size_t) const {
+        return elements.size();
+    }
+
+    Span span(size_t) {
+        Float4* e = elements.data();
+        return {&e->x, &e->y, &e->z, &e->w};
+    }
+
+    void set(size_t index, float x, float y, float z, float w) {
+        elements[index] = {x, y, z, w};
+    }
+
+private:
+    struct Float4 {
+        float x, y, z, w;
+    };
+
+    static_assert(sizeof(Float4) == STRIDE * sizeof(float), "Float4 must be tightly packed");
+
+    vector<Float4> elements;
+};
+
+class SoA {
+public:
+    static const size_t STRIDE = 1;
+
+    explicit SoA(size_t size) : x(size), y(size), z(size), w(size) {}
+
+    size_t spanCount() const {
+        return 1;
+    }
+
+    size_t spanOffset(size_t) const {
+        return 0;
+    }
+
+    size_t spanLength(size_t) const {
+        return x.size();
+    }
+
+    Span span(size_t) {
+        return {x.data(), y.data(), z.data(), w.data()};
+    }
+
+    void set(size_t index, float x, float y, float z, float w) {
+        this->x[index] = x;
+        this->y[index] = y;
+        this->z[index] = z;
+        this->w[index] = w;
+    }
+
+private:
+    vector<float> x, y, z, w;
+};
+
+class AoSoA {
+public:
+    static const size_t STRIDE = 1;
+
+    explicit AoSoA(size_t size) : size(size), blocks((size + LANES - 1) / LANES) {}
+
+    size_t spanCount() const {
+        return blocks.size();
+    }
+
+    size_t spanOffset(size_t index) const {
+        return index * LANES;
+    }
+
+    // The last block is only partly used when the size is not a multiple of LANES.
+    size_t spanLength(size_t index) const {
+        return std::min(LANES, size - spanOffset(index));
+    }
+
+    Span span(size_t index) {
+        Block& block = blocks[index];
+        return {block.x, block.y, block.z, block.w};
+    }
+
+    void set(size_t index, float x, float y, float z, float w) {
+        Block& block = blocks[index / LANES];
+        const size_t lane = index % LANES;
+        block.x[lane] = x;
+        block.y[lane] = y;
+        block.z[lane] = z;
+        block.w[lane] = w;
+    }
+
+private:
+    struct Block {
+        float x[LANES], y[LANES], z[LANES], w[LANES];
+    };
+
+    size_t size;
+    vector<Block> blocks;
+};
+
+// Matrices keep each of their four rows in its own Layout.
+template<class Layout>
+class Mat4Layout {
+public:
+    static const size_t STRIDE = Layout::STRIDE;
+
+    explicit Mat4Layout(size_t size) : rows(4, Layout(size)) {}
+
+    size_t spanCount() const {
+        return rows[0].spanCount();
+    }
+
+    size_t spanLength(size_t index) const {
+        return rows[0].spanLength(index);
+    }
+
+    void spans(size_t index, Span result[4]) {
+        for (int row = 0; row < 4; ++row)
+            result[row] = rows[row].span(index);
+    }
+
+    void set(size_t index, const Mat4& matrix) {
+        const Vec4* matrixRows[] = {&matrix.v1, &matrix.v2, &matrix.v3, &matrix.vt};
+        for (int row = 0; row < 4; ++row)
+            rows[row].set(index, matrixRows[row]->x, matrixRows[row]->y, matrixRows[row]->z, matrixRows[row]->w);
+    }
+
+private:
+    vector<Layout> rows;
+};
+
+// An AoS matrix keeps all sixteen floats together, so its rows are interleaved 16 floats apart.
+template<>
+class Mat4Layout<AoS> {
+public:
+    static const size_t STRIDE = 16;
+
+    explicit Mat4Layout(size_t size) : elements(size) {}
+
+    size_t spanCount() const {
+        return 1;
+    }
+
+    size_t spanLength(size_t) const {
+        return elements.size();
+    }
+
+    void spans(size_t, Span result[4]) {
+        float* m = elements.data()->m;
+        for (int row = 0; row < 4; ++row)
+            result[row] = {m + row * 4, m + row * 4 + 1, m + row * 4 + 2, m + row * 4 + 3};
+    }
+
+    void set(size_t index, const Mat4& matrix) {
+        const Vec4* matrixRows[] = {&matrix.v1, &matrix.v2, &matrix.v3, &matrix.vt};
+        float* m = elements[index].m;
+        for (int row = 0; row < 4; ++row) {
+            m[row * 4] = matrixRows[row]->x;
+            m[row * 4 + 1] = matrixRows[row]->y;
+            m[row * 4 + 2] = matrixRows[row]->z;
+            m[row * 4 + 3] = matrixRows[row]->w;
+        }
+    }
+
+private:
+    struct Float16 {
+        float m[16];
+    };
+
+    vector<Float16> elements;
+};
+
+// Deterministic test data. Every layout, and the API baseline, builds its first operand from
+// offset 0 and its second one from offset 1, so all of them process identical values.
+static Vec4 vectorAt(size_t index) {
+    return Vec4(0.5f + index % 7, 1.5f - index % 5, 0.25f + index % 3, 1);
+}
+
+static Quaternion quaternionAt(size_t index) {
+    Vec4 axis(0.2666, -0.5347f, 0.8019);
+    return Quaternion((index % 360) * TO_RADIANS, axis);
+}
+
+static Mat4 matrixAt(size_t index) {
+    Mat4 matrix = quaternionAt(index).toMatrix();
+    matrix.translate(index % 3, index % 5, index % 7);
+    return matrix;
+}
+
+static EulerAngles eulerAnglesAt(size_t index) {
+    EulerAngles eulerAngles;
+    eulerAngles.heading(index % 360 - 180.0f);
+    eulerAngles.pitch(index % 180 - 90.0f);
+    eulerAngles.bank(index % 360 - 180.0f);
+    return eulerAngles;
+}
+
+template<class Layout>
+static Layout vectors(size_t size, size_t offset = 0) {
+    Layout layout(size);
+    for (size_t i = 0; i < size; ++i) {
+        Vec4 vector = vectorAt(i + offset);
+        layout.set(i, vector.x, vector.y, vector.z, vector.w);
+    }
+    return layout;
+}
+
+template<class Layout>
+static Layout quaternions(size_t size, size_t offset = 0) {
+    Layout layout(size);
+    for (size_t i = 0; i < size; ++i) {
+        Quaternion quaternion = quaternionAt(i + offset);
+        layout.set(i, quaternion.x(), quaternion.y(), quaternion.z(), quaternion.w());
+    }
+    return layout;
+}
+
+template<class Layout>
+static Mat4Layout<Layout> matrices(size_t size, size_t offset = 0) {
+    Mat4Layout<Layout> layout(size);
+    for (size_t i = 0; i < size; ++i)
+        layout.set(i, matrixAt(i + offset));
+    return layout;
+}
+
+template<class Layout>
+static Layout eulerAngles(size_t size) {
+    Layout layout(size);
+    for (size_t i = 0; i < size; ++i) {
+        EulerAngles eulerAngles = eulerAnglesAt(i);
+        layout.set(i, eulerAngles.heading(), eulerAngles.pitch(), eulerAngles.bank(), 0);
+    }
+    return layout;
+}
+
+// Span kernels. They mirror the arithmetic of the corresponding library operations on
+// component arrays: vectors are rows multiplied by the matrix on the right, quaternions
+// use the Hamilton product and angles are given in degrees.
+
+template<size_t STRIDE>
+static void dotSpan(Span a, Span b, float* result, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        const size_t j = i * STRIDE;
+        result[i] = a.x[j] * b.x[j] + a.y[j] * b.y[j] + a.z[j] * b.z[j];
+    }
+}
+
+template<size_t STRIDE>
+static void normalizeSpan(Span v, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        const size_t j = i * STRIDE;
+        float inverseLength = 1 / sqrtf(v.x[j] * v.x[j] + v.y[j] * v.y[j] + v.z[j] * v.z[j]);
+        v.x[j] *= inverseLength;
+        v.y[j] *= inverseLength;
+        v.z[j] *= inverseLength;
+    }
+}
+
+template<size_t STRIDE>
+static void transformSpan(Span v, Span result, const Mat4& m, size_t count) {
+    // Local copies, so stores to result cannot force the matrix to be reloaded.
+    const float x1 = m.v1.x, y1 = m.v1.y, z1 = m.v1.z, w1 = m.v1.w;
+    const float x2 = m.v2.x, y2 = m.v2.y, z2 = m.v2.z, w2 = m.v2.w;
+    const float x3 = m.v3.x, y3 = m.v3.y, z3 = m.v3.z, w3 = m.v3.w;
+    const float xt = m.vt.x, yt = m.vt.y, zt = m.vt.z, wt = m.vt.w;
+    for (size_t i = 0; i < count; ++i) {
+        const size_t j = i * STRIDE;
+        float x = v.x[j], y = v.y[j], z = v.z[j], w = v.w[j];
+        result.x[j] = x * x1 + y * x2 + z * x3 + w * xt;
+        result.y[j] = x * y1 + y * y2 + z * y3 + w * yt;
+        result.z[j] = x * z1 + y * z2 + z * z3 + w * zt;
+        result.w[j] = x * w1 + y * w2 + z * w3 + w * wt;
+    }
+}
+
+// One entry of the product for every element of a span. The pointers are restrict parameters
+// rather than locals, because GCC ignores restrict on local pointers.
+template<size_t STRIDE>
+static void multiplyEntrySpan(float* __restrict__ r,
+        const float* __restrict__ a0, const float* __restrict__ a1, const float* __restrict__ a2, const float* __restrict__ a3,
+        const float* __restrict__ b0, const float* __restrict__ b1, const float* __restrict__ b2, const float* __restrict__ b3,
+        size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        const size_t j = i * STRIDE;
+        r[j] = a0[j] * b0[j] + a1[j] * b1[j] + a2[j] * b2[j] + a3[j] * b3[j];
+    }
+}
+
+template<size_t STRIDE>
+static void multiplyMatrixSpan(const Span a[4], const Span b[4], const Span result[4], size_t count) {
+    for (int row = 0; row < 4; ++row)
+        for (int column = 0; column < 4; ++column)
+            multiplyEntrySpan<STRIDE>(result[row][column], a[row].x, a[row].y, a[row].z, a[row].w,
+                    b[0][column], b[1][column], b[2][column], b[3][column], count);
+}
+
+template<size_t STRIDE>
+static void multiplyQuaternionSpan(Span a, Span b, Span result, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        const size_t j = i * STRIDE;
+        float w1 = a.w[j], x1 = a.x[j], y1 = a.y[j], z1 = a.z[j];
+        float w2 = b.w[j], x2 = b.x[j], y2 = b.y[j], z2 = b.z[j];
+        result.w[j] = w1 * w2 - x1 * x2 - y1 * y2 - z1 * z2;
+        result.x[j] = w1 * x2 + x1 * w2 + y1 * z2 - z1 * y2;
+        result.y[j] = w1 * y2 + y1 * w2 + z1 * x2 - x1 * z2;
+        result.z[j] = w1 * z2 + z1 * w2 + x1 * y2 - y1 * x2;
+    }
+}
+
+template<size_t STRIDE>
+static void slerpSpan(Span a, Span b, Span result, float fraction, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        const size_t j = i * STRIDE;
+        float cosine = a.w[j] * b.w[j] + a.x[j] * b.x[j] + a.y[j] * b.y[j] + a.z[j] * b.z[j];
+        // Take the shorter arc, like the library: when the cosine is negative, negate it and b.
+        // Negating k1 negates b in the blend below.
+        float sign = cosine < 0 ? -1.0f : 1.0f;
+        cosine *= sign;
+        float k0 = 1 - fraction, k1 = fraction;
+        if (cosine < 0.9999f) {
+            float angle = acosf(cosine);
+            float inverseSine = 1 / sinf(angle);
+            k0 = sinf((1 - fraction) * angle) * inverseSine;
+            k1 = sinf(fraction * angle) * inverseSine;
+        }
+        k1 *= sign;
+        result.w[j] = k0 * a.w[j] + k1 * b.w[j];
+        result.x[j] = k0 * a.x[j] + k1 * b.x[j];
+        result.y[j] = k0 * a.y[j] + k1 * b.y[j];
+        result.z[j] = k0 * a.z[j] + k1 * b.z[j];
+    }
+}
+
+template<size_t STRIDE>
+static void eulerToQuaternionSpan(Span angles, Span result, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        const size_t j = i * STRIDE;
+        float h = angles.x[j] * TO_RADIANS / 2, p = angles.y[j] * TO_RADIANS / 2, b = angles.z[j] * TO_RADIANS / 2;
+        float sh = sinf(h), ch = cosf(h), sp = sinf(p), cp = cosf(p), sb = sinf(b), cb = cosf(b);
+        result.w[j] = ch * cp * cb + sh * sp * sb;
+        result.x[j] = ch * sp * cb + sh * cp * sb;
+        result.y[j] = sh * cp * cb - ch * sp * sb;
+        result.z[j] = ch * cp * sb - sh * sp * cb;
+    }
+}
+
+// Bytes each kernel reads and writes per element. Every row of a kernel reports the same count,
+// so layouts that drag unused components through the cache show up as lower GB/s.
+static const size_t DOT_BYTES = 7 * sizeof(float);
+static const size_t NORMALIZE_BYTES = 6 * sizeof(float);
+static const size_t TRANSFORM_BYTES = 8 * sizeof(float);
+static const size_t MATRIX_MULTIPLY_BYTES = 48 * sizeof(float);
+static const size_t QUATERNION_BYTES = 12 * sizeof(float);
+static const size_t EULER_BYTES = 7 * sizeof(float);
+
+// The "_api" rows run the same kernels through the library objects and their out-of-line
+// operations. They are a baseline for API overhead, not another layout.
+
+// Vec4 dot product
+
+static void vec_dot_api(benchmark::State& state) {
+    const size_t size = state.range_x();
+    vector<Vec4> a(size), b(size);
+    vector<float> result(size);
+    for (size_t i = 0; i < size; ++i) {
+        a[i] = vectorAt(i);
+        b[i] = vectorAt(i + 1);
+    }
+    LayoutReport report;
+    while (state.KeepRunning())
+        for (size_t i = 0; i < size; ++i)
+            result[i] = a[i] | b[i];
+    report.finish(state, size, DOT_BYTES);
+}
+BENCHMARK(vec_dot_api)->Range(MIN_ELEMENTS, MAX_ELEMENTS);
+
+template<class Layout>
+static void vec_dot(benchmark::State& state) {
+    const size_t size = state.range_x();
+    Layout a = vectors<Layout>(size), b = vectors<Layout>(size, 1);
+    vector<float> result(size);
+    LayoutReport report;
+    while (state.KeepRunning())
+        for (size_t s = 0; s < a.spanCount(); ++s)
+            dotSpan<Layout::STRIDE>(a.span(s), b.span(s), &result[a.spanOffset(s)], a.spanLength(s));
+    report.finish(state, size, DOT_BYTES);
+}
+BENCHMARK_TEMPLATE(vec_dot, AoS)->Range(MIN_ELEMENTS, MAX_ELEMENTS);
+BENCHMARK_TEMPLATE(vec_dot, SoA)->Range(MIN_ELEMENTS, MAX_ELEMENTS);
+BENCHMARK_TEMPLATE(vec_dot, AoSoA)->Range(MIN_ELEMENTS, MAX_ELEMENTS);
+
+// Vec4 normalize
+
+static void vec_normalize_api(benchmark::State& state) {
+    const size_t size = state.range_x();
+    vector<Vec4> v(size);
+    for (size_t i = 0; i < size; ++i)
+        v[i] = vectorAt(i);
+    LayoutReport report;
+    while (state.KeepRunning())
+        for (size_t i = 0; i < size; ++i)
+            v[i].normalize();
+    report.finish(state, size, NORMALIZE_BYTES);
+}
+BENCHMARK(vec_normalize_api)->Range(MIN_ELEMENTS, MAX_ELEMENTS);
+
+template<class Layout>
+static void vec_normalize(benchmark::State& state) {
+    const size_t size = state.range_x();
+    Layout v = vectors<Layout>(size);
+    LayoutReport report;
+    while (state.KeepRunning())
+        for (size_t s = 0; s < v.spanCount(); ++s)
+            normalizeSpan<Layout::STRIDE>(v.span(s), v.spanLength(s));
+    report.finish(state, size, NORMALIZE_BYTES);
+}
+BENCHMARK_TEMPLATE(vec_normalize, AoS)->Range(MIN_ELEMENTS, MAX_ELEMENTS);
+BENCHMARK_TEMPLATE(vec_normalize, SoA)->Range(MIN_ELEMENTS, MAX_ELEMENTS);
+BENCHMARK_TEMPLATE(vec_normalize, AoSoA)->Range(MIN_ELEMENTS, MAX_ELEMENTS);
+
+// Mat4 transform
+
+static void mat_transform_api(benchmark::State& state) {
+    const size_t size = state.range_x();
+    vector<Vec4> v(size), result(size);
+    for (size_t i = 0; i < size; ++i)
+        v[i] = vectorAt(i);
+    Mat4 matrix = matrixAt(1);
+    LayoutReport report;
+    while (state.KeepRunning())
+        for (size_t i = 0; i < size; ++i)
+            result[i] = v[i] * matrix;
+    report.finish(state, size, TRANSFORM_BYTES);
+}
+BENCHMARK(mat_transform_api)->Range(MIN_ELEMENTS, MAX_ELEMENTS);
+
+template<class Layout>
+static void mat_transform(benchmark::State& state) {
+    const size_t size = state.range_x();
+    Layout v = vectors<Layout>(size), result(size);
+    Mat4 matrix = matrixAt(1);
+    LayoutReport report;
+    while (state.KeepRunning())
+        for (size_t s = 0; s < v.spanCount(); ++s)
+            transformSpan<Layout::STRIDE>(v.span(s), result.span(s), matrix, v.spanLength(s));
+    report.finish(state, size, TRANSFORM_BYTES);
+}
+BENCHMARK_TEMPLATE(mat_transform, AoS)->Range(MIN_ELEMENTS, MAX_ELEMENTS);
+BENCHMARK_TEMPLATE(mat_transform, SoA)->Range(MIN_ELEMENTS, MAX_ELEMENTS);
+BENCHMARK_TEMPLATE(mat_transform, AoSoA)->Range(MIN_ELEMENTS, MAX_ELEMENTS);
+
+// Mat4 multiply
+
+static void mat_multiply_api(benchmark::State& state) {
+    const size_t size = state.range_x();
+    vector<Mat4> a(size), b(size), result(size);
+    for (size_t i = 0; i < size; ++i) {
+        a[i] = matrixAt(i);
+        b[i] = matrixAt(i + 1);
+    }
+    LayoutReport report;
+    while (state.KeepRunning())
+        for (size_t i = 0; i < size; ++i)
+            result[i] = a[i] * b[i];
+    report.finish(state, size, MATRIX_MULTIPLY_BYTES);
+}
+BENCHMARK(mat_multiply_api)->Range(MIN_ELEMENTS, MAX_MATRICES);
+
+template<class Layout>
+static void mat_multiply(benchmark::State& state) {
+    const size_t size = state.range_x();
+    Mat4Layout<Layout> a = matrices<Layout>(size), b = matrices<Layout>(size, 1), result(size);
+    LayoutReport report;
+    while (state.KeepRunning())
+        for (size_t s = 0; s < a.spanCount(); ++s) {
+            Span as[4], bs[4], rs[4];
+            a.spans(s, as);
+            b.spans(s, bs);
+            result.spans(s, rs);
+            multiplyMatrixSpan<Mat4Layout<Layout>::STRIDE>(as, bs, rs, a.spanLength(s));
+        }
+    report.finish(state, size, MATRIX_MULTIPLY_BYTES);
+}
+BENCHMARK_TEMPLATE(mat_multiply, AoS)->Range(MIN_ELEMENTS, MAX_MATRICES);
+BENCHMARK_TEMPLATE(mat_multiply, SoA)->Range(MIN_ELEMENTS, MAX_MATRICES);
+BENCHMARK_TEMPLATE(mat_multiply, AoSoA)->Range(MIN_ELEMENTS, MAX_MATRICES);
+
+// Quaternion multiply
+
+static void quat_multiply_api(benchmark::State& state) {
+    const size_t size = state.range_x();
+    vector<Quaternion> a(size), b(size), result(size);
+    for (size_t i = 0; i < size; ++i) {
+        a[i] = quaternionAt(i);
+        b[i] = quaternionAt(i + 1);
+    }
+    LayoutReport report;
+    while (state.KeepRunning())
+        for (size_t i = 0; i < size; ++i)
+            result[i] = a[i] * b[i];
+    report.finish(state, size, QUATERNION_BYTES);
+}
+BENCHMARK(quat_multiply_api)->Range(MIN_ELEMENTS, MAX_ELEMENTS);
+
+template<class Layout>
+static void quat_multiply(benchmark::State& state) {
+    const size_t size = state.range_x();
+    Layout a = quaternions<Layout>(size), b = quaternions<Layout>(size, 1), result(size);
+    LayoutReport report;
+    while (state.KeepRunning())
+        for (size_t s = 0; s < a.spanCount(); ++s)
+            multiplyQuaternionSpan<Layout::STRIDE>(a.span(s), b.span(s), result.span(s), a.spanLength(s));
+    report.finish(state, size, QUATERNION_BYTES);
+}
+BENCHMARK_TEMPLATE(quat_multiply, AoS)->Range(MIN_ELEMENTS, MAX_ELEMENTS);
+BENCHMARK_TEMPLATE(quat_multiply, SoA)->Range(MIN_ELEMENTS, MAX_ELEMENTS);
+BENCHMARK_TEMPLATE(quat_multiply, AoSoA)->Range(MIN_ELEMENTS, MAX_ELEMENTS);
+
+// Quaternion slerp
+
+static void quat_slerp_api(benchmark::State& state) {
+    const size_t size = state.range_x();
+    vector<Quaternion> a(size), b(size), result(size);
+    for (size_t i = 0; i < size; ++i) {
+        a[i] = quaternionAt(i);
+        b[i] = quaternionAt(i + 1);
+    }
+    LayoutReport report;
+    while (state.KeepRunning())
+        for (size_t i = 0; i < size; ++i)
+            result[i] = a[i].slerp(b[i], SLERP_FRACTION);
+    report.finish(state, size, QUATERNION_BYTES);
+}
+BENCHMARK(quat_slerp_api)->Range(MIN_ELEMENTS, MAX_ELEMENTS);
+
+template<class Layout>
+static void quat_slerp(benchmark::State& state) {
+    const size_t size = state.range_x();
+    Layout a = quaternions<Layout>(size), b = quaternions<Layout>(size, 1), result(size);
+    LayoutReport report;
+    while (state.KeepRunning())
+        for (size_t s = 0; s < a.spanCount(); ++s)
+            slerpSpan<Layout::STRIDE>(a.span(s), b.span(s), result.span(s), SLERP_FRACTION, a.spanLength(s));
+    report.finish(state, size, QUATERNION_BYTES);
+}
+BENCHMARK_TEMPLATE(quat_slerp, AoS)->Range(MIN_ELEMENTS, MAX_ELEMENTS);
+BENCHMARK_TEMPLATE(quat_slerp, SoA)->Range(MIN_ELEMENTS, MAX_ELEMENTS);
+BENCHMARK_TEMPLATE(quat_slerp, AoSoA)->Range(MIN_ELEMENTS, MAX_ELEMENTS);
+
+// EulerAngles to Quaternion
+
+static void euler_to_quaternion_api(benchmark::State& state) {
+    const size_t size = state.range_x();
+    vector<EulerAngles> angles(size);
+    vector<Quaternion> result(size);
+    for (size_t i = 0; i < size; ++i)
+        angles[i] = eulerAnglesAt(i);
+    LayoutReport report;
+    while (state.KeepRunning())
+        for (size_t i = 0; i < size; ++i)
+            result[i] = angles[i].toObjectQuaternion();
+    report.finish(state, size, EULER_BYTES);
+}
+BENCHMARK(euler_to_quaternion_api)->Range(MIN_ELEMENTS, MAX_ELEMENTS);
+
+template<class Layout>
+static void euler_to_quaternion(benchmark::State& state) {
+    const size_t size = state.range_x();
+    Layout angles = eulerAngles<Layout>(size), result(size);
+    LayoutReport report;
+    while (state.KeepRunning())
+        for (size_t s = 0; s < angles.spanCount(); ++s)
+            eulerToQuaternionSpan<Layout::STRIDE>(angles.span(s), result.span(s), angles.spanLength(s));
+    report.finish(state, size, EULER_BYTES);
+}
+BENCHMARK_TEMPLATE(euler_to_quaternion, AoS)->Range(MIN_ELEMENTS, MAX_ELEMENTS);
+BENCHMARK_TEMPLATE(euler_to_quaternion, SoA)->Range(MIN_ELEMENTS, MAX_ELEMENTS);
+BENCHMARK_TEMPLATE(euler_to_quaternion, AoSoA)->Range(MIN_ELEMENTS, MAX_ELEMENTS);
@@ -0,0 +1,58 @@
+#include <benchmark/benchmark_api.h>
+#include <vector>
+#include <Mat4.h>
+
+using namespace flash::math;
+
+// Loops over calls into flash math. This file is built at -O2 in every configuration, so the only
+// difference FLASH_MATH_LTO makes here is whether the library calls can be inlined into the loops.
+static const size_t LOOP_SIZE = 4096;
+
+static void vec_addition_loop(benchmark::State& state) {
+    std::vector<Vec4> vectors(LOOP_SIZE, Vec4(1, 0.23, 3));
+    while (state.KeepRunning()) {
+        Vec4 sum;
+        for (size_t i = 0; i < LOOP_SIZE; ++i)
+            sum += vectors[i];
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * LOOP_SIZE);
+}
+BENCHMARK(vec_addition_loop);
+
+static void vec_dotProduct_loop(benchmark::State& state) {
+    std::vector<Vec4> vectors(LOOP_SIZE, Vec4(1, 0.23, 3)), vectors2(LOOP_SIZE, Vec4(0.342342, 2.234, -1.10001414f));
+    while (state.KeepRunning()) {
+        float sum = 0;
+        for (size_t i = 0; i < LOOP_SIZE; ++i)
+            sum += vectors[i] | vectors2[i];
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * LOOP_SIZE);
+}
+BENCHMARK(vec_dotProduct_loop);
+
+static void mat_accessors_loop(benchmark::State& state) {
+    std::vector<Mat4> matrices(LOOP_SIZE, Mat4(3, 2, 1, 1, 3, 2, 2, 1, 3, 3, 4, 5));
+    while (state.KeepRunning()) {
+        float sum = 0;
+        for (size_t i = 0; i < LOOP_SIZE; ++i)
+            sum += matrices[i].x1() + matrices[i].xt();
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * LOOP_SIZE);
+}
+BENCHMARK(mat_accessors_loop);
+
+static void mat_transform_loop(benchmark::State& state) {
+    std::vector<Vec4> vectors(LOOP_SIZE, Vec4(1, 0.23, 3));
+    Mat4 matrix;
+    matrix.rotateAboutZ(30);
+    while (state.KeepRunning()) {
+        for (size_t i = 0; i < LOOP_SIZE; ++i)
+            matrix.transform(vectors[i]);
+        benchmark::DoNotOptimize(vectors.data());
+    }
+    state.SetItemsProcessed(state.iterations() * LOOP_SIZE);
+}
+BENCHMARK(mat_transform_loop);
@@ -0,0 +1,143 @@
+#include <benchmark/benchmark_api.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <new>
+#include <thread>
+#include <vector>
+#include <EulerAngles.h>
+
+using namespace flash::math;
+
+using std::vector;
+
+// Every thread processes its own fixed slice of a shared batch, so chunk boundaries depend only
+// on the element count and the thread count, never on scheduling. Boundaries are rounded to whole
+// cache lines and the batches are cache-line aligned, so no two threads write the same line.
+static const size_t BATCH_SIZE = 1 << 18;
+static const size_t CACHE_LINE_SIZE = 64;
+
+template<class T>
+class CacheLineAllocator {
+public:
+    typedef T value_type;
+
+    CacheLineAllocator() = default;
+
+    template<class U>
+    CacheLineAllocator(const CacheLineAllocator<U>&) {}
+
+    T* allocate(size_t count) {
+        void* memory = nullptr;
+        if (posix_memalign(&memory, CACHE_LINE_SIZE, count * sizeof(T)) != 0)
+            throw std::bad_alloc();
+        return static_cast<T*>(memory);
+    }
+
+    void deallocate(T* pointer, size_t) {
+        free(pointer);
+    }
+};
+
+template<class T, class U>
+static bool operator==(const CacheLineAllocator<T>&, const CacheLineAllocator<U>&) {
+    return true;
+}
+
+template<class T, class U>
+static bool operator!=(const CacheLineAllocator<T>&, const CacheLineAllocator<U>&) {
+    return false;
+}
+
+template<class T>
+using Batch = vector<T, CacheLineAllocator<T>>;
+
+static int maxThreads() {
+    return std::max(1, (int) std::thread::hardware_concurrency());
+}
+
+// Smallest number of elements of T that spans a whole number of cache lines.
+template<class T>
+static size_t elementsPerLine() {
+    size_t a = sizeof(T), b = CACHE_LINE_SIZE;
+    while (b) {
+        size_t r = a % b;
+        a = b;
+        b = r;
+    }
+    return CACHE_LINE_SIZE / a;
+}
+
+template<class T>
+static size_t sliceBoundary(size_t thread, size_t threads) {
+    const size_t line = elementsPerLine<T>();
+    return std::min(BATCH_SIZE, (BATCH_SIZE * thread / threads + line / 2) / line * line);
+}
+
+template<class T>
+static size_t sliceBegin(const benchmark::State& state) {
+    return sliceBoundary<T>(state.thread_index, state.threads);
+}
+
+template<class T>
+static size_t sliceEnd(const benchmark::State& state) {
+    return sliceBoundary<T>(state.thread_index + 1, state.threads);
+}
+
+static Batch<Vec4>& vectors() {
+    static Batch<Vec4> data = [] {
+        Batch<Vec4> result(BATCH_SIZE);
+        for (size_t i = 0; i < BATCH_SIZE; ++i)
+            result[i] = Vec4(i * 0.001f, 1 - i * 0.002f, 0.5f + i * 0.003f, 1);
+        return result;
+    }();
+    return data;
+}
+
+static Batch<Quaternion>& quaternions() {
+    static Batch<Quaternion> data = [] {
+        Batch<Quaternion> result(BATCH_SIZE);
+        for (size_t i = 0; i < BATCH_SIZE; ++i)
+            result[i] = Quaternion(i * 0.0001f, Vec4(0.2666, -0.5347f, 0.8019));
+        return result;
+    }();
+    return data;
+}
+
+static void vec_transform_threads(benchmark::State& state) {
+    Batch<Vec4>& input = vectors();
+    static Batch<Vec4> output(BATCH_SIZE);
+    Mat4 matrix(0.866, 0.5, 0, -0.5f, 0.866, 0, 0, 0, 1, 3, 4, 5);
+    const size_t begin = sliceBegin<Vec4>(state), end = sliceEnd<Vec4>(state);
+    while (state.KeepRunning())
+        for (size_t i = begin; i < end; ++i)
+            output[i] = input[i] * matrix;
+    state.SetItemsProcessed(state.iterations() * (end - begin));
+}
+BENCHMARK(vec_transform_threads)->ThreadRange(1, maxThreads())->UseRealTime();
+
+static void quat_slerp_threads(benchmark::State& state) {
+    Batch<Quaternion>& input = quaternions();
+    static Batch<Quaternion> output(BATCH_SIZE);
+    Quaternion target(1.2f, Vec4(0, 1, 0));
+    const size_t begin = sliceBegin<Quaternion>(state), end = sliceEnd<Quaternion>(state);
+    while (state.KeepRunning())
+        for (size_t i = begin; i < end; ++i)
+            output[i] = input[i].slerp(target, 0.25);
+    state.SetItemsProcessed(state.iterations() * (end - begin));
+}
+BENCHMARK(quat_slerp_threads)->ThreadRange(1, maxThreads())->UseRealTime();
+
+static void euler_to_quaternion_threads(benchmark::State& state) {
+    static Batch<Quaternion> output(BATCH_SIZE);
+    const size_t begin = sliceBegin<Quaternion>(state), end = sliceEnd<Quaternion>(state);
+    EulerAngles eulerAngles;
+    while (state.KeepRunning())
+        for (size_t i = begin; i < end; ++i) {
+            eulerAngles.heading(i % 360 - 180.0f);
+            eulerAngles.pitch(i % 180 - 90.0f);
+            eulerAngles.bank(i % 90);
+            output[i] = eulerAngles.toObjectQuaternion();
+        }
+    state.SetItemsProcessed(state.iterations() * (end - begin));
+}
+BENCHMARK(euler_to_quaternion_threads)->ThreadRange(1, maxThreads())->UseRealTime();
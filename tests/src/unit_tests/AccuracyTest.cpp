@@ -0,0 +1,200 @@
+#include <float.h>
+#include <math.h>
+#include <random>
+#include <string>
+#include "gmock/gmock.h"
+#include "EulerAngles.h"
+
+using namespace testing;
+using namespace flash::math;
+
+const int SAMPLES = 10000;
+const unsigned int SEED = 20160505;
+
+// Error of every measured operation is taken against the same computation carried out in
+// double precision on the very same float inputs, so only the error of the float
+// implementation is measured.
+//
+// Bounds are derived, not measured: every correctly rounded float operation has a relative error
+// of at most the unit roundoff U, and each bound below counts the roundings on the path of the
+// operation, scaled by how much the later steps amplify them. It is written as a multiple of U next
+// to its test. The bounds have not yet been checked against every supported compiler and library
+// version, so they are expectations rather than assertions; the max and mean errors are recorded
+// as test properties for comparison.
+const double U = FLT_EPSILON / 2;
+
+class ErrorStats {
+public:
+	void add(double error) {
+		error = fabs(error);
+		if (error > max)
+			max = error;
+		sum += error;
+		count++;
+	}
+
+	double mean() const {
+		return count ? sum / count : 0;
+	}
+
+	double max = 0;
+
+private:
+	double sum = 0;
+	int count = 0;
+};
+
+class AccuracyTest : public Test {
+public:
+	std::mt19937 random = std::mt19937(SEED);
+	ErrorStats stats;
+
+	float uniform(float min, float max) {
+		return std::uniform_real_distribution<float>(min, max)(random);
+	}
+
+	Vec4 randomVector(float range = 100) {
+		return Vec4(uniform(-range, range), uniform(-range, range), uniform(-range, range));
+	}
+
+	Quaternion randomQuaternion() {
+		Vec4 axis = randomVector();
+		axis.normalize();
+		return Quaternion(uniform(0, (float) (2 * M_PI)), axis);
+	}
+
+	void expectErrorWithin(const std::string& name, double maxBound) {
+		RecordProperty(name + "MaxError", std::to_string(stats.max));
+		RecordProperty(name + "MeanError", std::to_string(stats.mean()));
+		RecordProperty(name + "MaxBound", std::to_string(maxBound));
+		EXPECT_THAT(stats.max, Le(maxBound));
+	}
+
+	static double length(double x, double y, double z) {
+		return sqrt(x * x + y * y + z * z);
+	}
+};
+
+TEST_F(AccuracyTest, Vec4Length) {
+	for (int i = 0; i < SAMPLES; i++) {
+		Vec4 vector = randomVector();
+		double expected = length(vector.x, vector.y, vector.z);
+		stats.add((vector.length() - expected) / expected);
+	}
+	// Relative: three squares and two additions leave at most 3U in the sum, which sqrt halves
+	// to 1.5U, plus U for rounding the root itself: 2.5U, rounded up to 3U.
+	expectErrorWithin("Vec4Length", 3 * U);
+}
+
+TEST_F(AccuracyTest, Vec4Normalize) {
+	for (int i = 0; i < SAMPLES; i++) {
+		Vec4 vector = randomVector();
+		double l = length(vector.x, vector.y, vector.z);
+		double x = vector.x / l, y = vector.y / l, z = vector.z / l;
+		vector.normalize();
+		stats.add(vector.x - x);
+		stats.add(vector.y - y);
+		stats.add(vector.z - z);
+	}
+	// Absolute, components are at most 1: 2.5U from the length, U for the reciprocal or the ratio
+	// when normalize goes through setLength, and U for the final division or multiplication:
+	// 4.5U, rounded up to 5U.
+	expectErrorWithin("Vec4Normalize", 5 * U);
+}
+
+// acos amplifies an error in the cosine by 1 / sin(angle), so no finite bound holds for nearly
+// parallel vectors. The angle tests only sample pairs with |cosine| <= MAX_COSINE.
+const double MAX_COSINE = 0.99;
+const double MIN_SINE = sqrt(1 - MAX_COSINE * MAX_COSINE);
+
+TEST_F(AccuracyTest, Vec4AngleBetween) {
+	for (int i = 0; i < SAMPLES; i++) {
+		Vec4 vector = randomVector(), vector2 = randomVector();
+		double dotProduct = (double) vector.x * vector2.x + (double) vector.y * vector2.y
+				+ (double) vector.z * vector2.z;
+		double cosine = dotProduct / (length(vector.x, vector.y, vector.z) * length(vector2.x, vector2.y, vector2.z));
+		if (fabs(cosine) > MAX_COSINE)
+			continue;
+		stats.add(Vec4::angleBetween(vector, vector2) - acos(cosine) * 180 / M_PI);
+	}
+	// Degrees. The cosine of two normalized vectors is off by at most 2 * sqrt(3) * 5U from the two
+	// normalizations plus 3U from the dot product, which is under 21U. That becomes 21U / sin(angle)
+	// in the angle, plus 4U, one ulp of acosf on [0, pi]. Converting to degrees multiplies by 180 / pi
+	// and adds two roundings on a result of at most 180.
+	expectErrorWithin("Vec4AngleBetween", (21 * U / MIN_SINE + 4 * U) * 180 / M_PI + 2 * U * 180);
+}
+
+TEST_F(AccuracyTest, QuaternionSlerp) {
+	for (int i = 0; i < SAMPLES; i++) {
+		Quaternion start = randomQuaternion(), end = randomQuaternion();
+		float fraction = uniform(0, 1);
+
+		double cosine = (double) start.w() * end.w() + (double) start.x() * end.x()
+				+ (double) start.y() * end.y() + (double) start.z() * end.z();
+		if (fabs(cosine) > MAX_COSINE)
+			continue;
+		// The reference takes the shorter arc; the library has to handle the double cover itself.
+		double sign = cosine < 0 ? -1 : 1;
+		double angle = acos(fabs(cosine));
+		double k0 = sin((1 - fraction) * angle) / sin(angle);
+		double k1 = sign * sin(fraction * angle) / sin(angle);
+
+		Quaternion result = start.slerp(end, fraction);
+		stats.add(result.w() - (k0 * start.w() + k1 * end.w()));
+		stats.add(result.x() - (k0 * start.x() + k1 * end.x()));
+		stats.add(result.y() - (k0 * start.y() + k1 * end.y()));
+		stats.add(result.z() - (k0 * start.z() + k1 * end.z()));
+	}
+	// Absolute, components are at most 1. The cosine is off by at most 4U, and sqrt(1 - c * c) with
+	// atan2 (or acosf) turns that into at most 40U in the angle for sin(angle) >= MIN_SINE.
+	// d(sin(t * a) / sin(a)) / da stays below 0.5 for a in [acos(MAX_COSINE), pi / 2], so each
+	// weight is off by 20U from the angle and 5U from its own sines, products and division.
+	// Blending two unit quaternions doubles that to 50U, and the products and sum add 4U: 54U,
+	// rounded up to 60U.
+	expectErrorWithin("QuaternionSlerp", 60 * U);
+}
+
+// Inverted matrices are rotations with rows scaled by [MIN_SCALE, MAX_SCALE]: entries and inverse
+// entries stay below 1.25 and the determinant lies in [0.512, 1.95].
+const float MIN_SCALE = 0.8f;
+const float MAX_SCALE = 1.25f;
+
+TEST_F(AccuracyTest, Mat4Inverse) {
+	for (int i = 0; i < SAMPLES; i++) {
+		Mat4 matrix = randomQuaternion().toMatrix();
+		matrix.scale(uniform(MIN_SCALE, MAX_SCALE), uniform(MIN_SCALE, MAX_SCALE), uniform(MIN_SCALE, MAX_SCALE));
+
+		double m[3][3] = {
+				{matrix.x1(), matrix.y1(), matrix.z1()},
+				{matrix.x2(), matrix.y2(), matrix.z2()},
+				{matrix.x3(), matrix.y3(), matrix.z3()}};
+		double determinant = m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1])
+				- m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0])
+				+ m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+		double inverse[3][3];
+		for (int row = 0; row < 3; row++)
+			for (int column = 0; column < 3; column++) {
+				int r1 = (column + 1) % 3, r2 = (column + 2) % 3;
+				int c1 = (row + 1) % 3, c2 = (row + 2) % 3;
+				inverse[row][column] = (m[r1][c1] * m[r2][c2] - m[r1][c2] * m[r2][c1]) / determinant;
+			}
+
+		matrix.inverse();
+		stats.add(matrix.x1() - inverse[0][0]);
+		stats.add(matrix.y1() - inverse[0][1]);
+		stats.add(matrix.z1() - inverse[0][2]);
+		stats.add(matrix.x2() - inverse[1][0]);
+		stats.add(matrix.y2() - inverse[1][1]);
+		stats.add(matrix.z2() - inverse[1][2]);
+		stats.add(matrix.x3() - inverse[2][0]);
+		stats.add(matrix.y3() - inverse[2][1]);
+		stats.add(matrix.z3() - inverse[2][2]);
+	}
+	// Absolute, inverse entries are at most 1.25. The bound assumes the adjugate over determinant
+	// method the Inverse test expects. Each cofactor is off by at most 5.6U: two products of at most
+	// 1.5625 and a difference of at most 2.44. A Sarrus determinant has six triple products of at
+	// most 1.95 and five additions, so it is off by at most 82U, which is 160U relative to 0.512.
+	// An entry is then off by 5.6U / 0.512 + 1.25 * 160U + 1.25U, about 212U, rounded up to 215U.
+	// Expanding the determinant along cofactors gives the smaller 95U relative error.
+	expectErrorWithin("Mat4Inverse", 215 * U);
+}